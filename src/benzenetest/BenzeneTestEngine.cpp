@@ -57,7 +57,7 @@ HexPoint BenzeneTestEngine::GenMove(HexColor color, bool useGameClock)
 void BenzeneTestEngine::CmdSetPlayer(HtpCommand& cmd)
 {
     cmd.CheckNuArg(1);
-    std::string name = cmd.Arg(0);
+    const std::string& name = cmd.Arg(0);
     if (name == "perfect")
         m_player.reset(new PerfectPlayer(m_dfpnSolver, m_dfpnPositions));
     else if (name == "none")
@@ -85,7 +85,7 @@ void BenzeneTestEngine::CmdParamPlayer(HtpCommand& cmd)
         }
         else if (cmd.NuArg() == 2)
         {
-            std::string name = cmd.Arg(0);
+            const std::string& name = cmd.Arg(0);
             if (name == "max_time")
                 player->SetMaxTime(cmd.ArgMin<float>(1, 0.0));
             else if (name == "propagate_backwards")
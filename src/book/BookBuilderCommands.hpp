@@ -117,7 +117,7 @@ void BookBuilderCommands<PLAYER>::CmdParamBookBuilder(HtpCommand& cmd)
     }
     else if (cmd.NuArg() == 2)
     {
-        std::string name = cmd.Arg(0);
+        const std::string& name = cmd.Arg(0);
         if (name == "alpha")
             m_bookBuilder.SetAlpha(cmd.ArgMin<float>(1, 0.0));
         else if (name == "expand_width")
@@ -278,7 +278,7 @@ void BookCommands::CmdBookParam(HtpCommand& cmd)
     }
     else if (cmd.NuArg() == 2)
     {
-        std::string name = cmd.Arg(0);
+        const std::string& name = cmd.Arg(0);
         if (name == "book_min_count")
             m_bookCheck.SetMinCount(cmd.ArgMin<unsigned>(1, 0));
         else if (name == "book_count_weight")
@@ -63,6 +63,15 @@ HexBoard::~HexBoard()
 {
 }
 
+void HexBoard::Resize(int width, int height)
+{
+    m_brd.SetSize(width, height);
+    m_patterns.BoardSizeChanged();
+    GroupBuilder::Build(m_brd, m_groups);
+    m_inf.Clear();
+    ClearHistory();
+}
+
 //----------------------------------------------------------------------------
 
 HexPoint HexBoard::ComputeInferiorCells(HexColor color_to_move,
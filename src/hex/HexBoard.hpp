@@ -37,6 +37,12 @@ public:
     /** Destructor. */
     ~HexBoard();
 
+    /** Changes the size of the board, reusing the already-allocated
+        ICE and pattern caches instead of rebuilding them from
+        scratch. Clears the position and the history; parameters are
+        untouched. */
+    void Resize(int width, int height);
+
     //-----------------------------------------------------------------------
 
     /** @name Parameters */
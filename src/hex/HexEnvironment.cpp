@@ -2,13 +2,222 @@
 /** @file HexEnvironment.cpp */
 //----------------------------------------------------------------------------
 
-#include <boost/format.hpp>
+#include <unordered_map>
+
 #include "HexEnvironment.hpp"
 
 using namespace benzene;
 
 //----------------------------------------------------------------------------
 
+namespace {
+
+//----------------------------------------------------------------------------
+
+/** Builds the name to identifier map for a parameter table. */
+template<typename ENTRY, std::size_t N>
+std::unordered_map<std::string, decltype(ENTRY::id)>
+BuildParamLookup(const ENTRY (&table)[N])
+{
+    std::unordered_map<std::string, decltype(ENTRY::id)> lookup;
+    for (std::size_t i = 0; i < N; ++i)
+        lookup[table[i].name] = table[i].id;
+    return lookup;
+}
+
+//----------------------------------------------------------------------------
+
+/** Parameters of param_*_ice, interned as small integers so that
+    dispatch is one hashed lookup and a jump table instead of a chain
+    of string compares. */
+enum class IceParamId : uint8_t
+{
+    FIND_ALL_PATTERN_SUPERIORS,
+    FIND_ALL_PATTERN_KILLERS,
+    FIND_PRESIMPLICIAL_PAIRS,
+    FIND_THREE_SIDED_DEAD_REGIONS,
+    ITERATIVE_DEAD_REGIONS,
+    USE_CAPTURE,
+    FIND_REVERSIBLE,
+    USE_S_REVERSIBLE_AS_REVERSIBLE,
+    UNKNOWN
+};
+
+struct IceParamEntry
+{
+    const char* name;
+    IceParamId id;
+};
+
+/** Names in printing order. */
+const IceParamEntry ICE_PARAM_TABLE[] =
+{
+    { "find_all_pattern_superiors", IceParamId::FIND_ALL_PATTERN_SUPERIORS },
+    { "find_all_pattern_killers", IceParamId::FIND_ALL_PATTERN_KILLERS },
+    { "find_presimplicial_pairs", IceParamId::FIND_PRESIMPLICIAL_PAIRS },
+    { "find_three_sided_dead_regions",
+      IceParamId::FIND_THREE_SIDED_DEAD_REGIONS },
+    { "iterative_dead_regions", IceParamId::ITERATIVE_DEAD_REGIONS },
+    { "use_capture", IceParamId::USE_CAPTURE },
+    { "find_reversible", IceParamId::FIND_REVERSIBLE },
+    { "use_s_reversible_as_reversible",
+      IceParamId::USE_S_REVERSIBLE_AS_REVERSIBLE }
+};
+
+IceParamId LookupIceParam(const std::string& name)
+{
+    static const std::unordered_map<std::string, IceParamId> lookup
+        = BuildParamLookup(ICE_PARAM_TABLE);
+    auto it = lookup.find(name);
+    return it != lookup.end() ? it->second : IceParamId::UNKNOWN;
+}
+
+bool IceParamValue(const ICEngine& ice, IceParamId id)
+{
+    switch (id)
+    {
+    case IceParamId::FIND_ALL_PATTERN_SUPERIORS:
+        return ice.FindAllPatternSuperiors();
+    case IceParamId::FIND_ALL_PATTERN_KILLERS:
+        return ice.FindAllPatternKillers();
+    case IceParamId::FIND_PRESIMPLICIAL_PAIRS:
+        return ice.FindPresimplicialPairs();
+    case IceParamId::FIND_THREE_SIDED_DEAD_REGIONS:
+        return ice.FindThreeSidedDeadRegions();
+    case IceParamId::ITERATIVE_DEAD_REGIONS:
+        return ice.IterativeDeadRegions();
+    case IceParamId::USE_CAPTURE:
+        return ice.UseCapture();
+    case IceParamId::FIND_REVERSIBLE:
+        return ice.FindReversible();
+    case IceParamId::USE_S_REVERSIBLE_AS_REVERSIBLE:
+        return ice.UseSReversibleAsReversible();
+    default:
+        BenzeneAssert(false);
+        return false;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/** Parameters of param_*_vc. */
+enum class VCParamId : uint8_t
+{
+    AND_OVER_EDGE,
+    USE_PATTERNS,
+    USE_NON_EDGE_PATTERNS,
+    INCREMENTAL_BUILDS,
+    LIMIT_FULLS,
+    LIMIT_OR,
+    UNKNOWN
+};
+
+struct VCParamEntry
+{
+    const char* name;
+    VCParamId id;
+};
+
+/** Names in printing order. */
+const VCParamEntry VC_PARAM_TABLE[] =
+{
+    { "and_over_edge", VCParamId::AND_OVER_EDGE },
+    { "use_patterns", VCParamId::USE_PATTERNS },
+    { "use_non_edge_patterns", VCParamId::USE_NON_EDGE_PATTERNS },
+    { "incremental_builds", VCParamId::INCREMENTAL_BUILDS },
+    { "limit_fulls", VCParamId::LIMIT_FULLS },
+    { "limit_or", VCParamId::LIMIT_OR }
+};
+
+VCParamId LookupVCParam(const std::string& name)
+{
+    static const std::unordered_map<std::string, VCParamId> lookup
+        = BuildParamLookup(VC_PARAM_TABLE);
+    auto it = lookup.find(name);
+    return it != lookup.end() ? it->second : VCParamId::UNKNOWN;
+}
+
+bool VCParamValue(const VCBuilderParam& param, VCParamId id)
+{
+    switch (id)
+    {
+    case VCParamId::AND_OVER_EDGE:
+        return param.and_over_edge;
+    case VCParamId::USE_PATTERNS:
+        return param.use_patterns;
+    case VCParamId::USE_NON_EDGE_PATTERNS:
+        return param.use_non_edge_patterns;
+    case VCParamId::INCREMENTAL_BUILDS:
+        return param.incremental_builds;
+    case VCParamId::LIMIT_FULLS:
+        return param.limit_fulls;
+    case VCParamId::LIMIT_OR:
+        return param.limit_or;
+    default:
+        BenzeneAssert(false);
+        return false;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/** Parameters of param_*_board. */
+enum class BoardParamId : uint8_t
+{
+    BACKUP_ICE_INFO,
+    USE_DECOMPOSITIONS,
+    USE_ICE,
+    USE_VCS,
+    UNKNOWN
+};
+
+struct BoardParamEntry
+{
+    const char* name;
+    BoardParamId id;
+};
+
+/** Names in printing order. */
+const BoardParamEntry BOARD_PARAM_TABLE[] =
+{
+    { "backup_ice_info", BoardParamId::BACKUP_ICE_INFO },
+    { "use_decompositions", BoardParamId::USE_DECOMPOSITIONS },
+    { "use_ice", BoardParamId::USE_ICE },
+    { "use_vcs", BoardParamId::USE_VCS }
+};
+
+BoardParamId LookupBoardParam(const std::string& name)
+{
+    static const std::unordered_map<std::string, BoardParamId> lookup
+        = BuildParamLookup(BOARD_PARAM_TABLE);
+    auto it = lookup.find(name);
+    return it != lookup.end() ? it->second : BoardParamId::UNKNOWN;
+}
+
+bool BoardParamValue(const HexBoard& brd, BoardParamId id)
+{
+    switch (id)
+    {
+    case BoardParamId::BACKUP_ICE_INFO:
+        return brd.BackupIceInfo();
+    case BoardParamId::USE_DECOMPOSITIONS:
+        return brd.UseDecompositions();
+    case BoardParamId::USE_ICE:
+        return brd.UseICE();
+    case BoardParamId::USE_VCS:
+        return brd.UseVCs();
+    default:
+        BenzeneAssert(false);
+        return false;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+} // namespace
+
+//----------------------------------------------------------------------------
+
 HexEnvironment::HexEnvironment(int width, int height)
     : brd(0)
 {
@@ -17,21 +226,9 @@ HexEnvironment::HexEnvironment(int width, int height)
 
 void HexEnvironment::NewGame(int width, int height)
 {
-    if (brd->GetPosition().Width() != width 
+    if (brd->GetPosition().Width() != width
         || brd->GetPosition().Height() != height)
-    {
-        /** @todo Make board resizable? Until then, make sure all
-            HexBoard parameters are copied here! */
-        bool use_vcs = brd->UseVCs();
-        bool use_ice = brd->UseICE();
-        bool use_dec = brd->UseDecompositions();
-        bool backup  = brd->BackupIceInfo();
-        brd.reset(new HexBoard(width, height, ice, buildParam));
-        brd->SetUseVCs(use_vcs);
-        brd->SetUseICE(use_ice);
-        brd->SetUseDecompositions(use_dec);
-        brd->SetBackupIceInfo(backup);
-    }
+        brd->Resize(width, height);
     brd->GetPosition().StartNewGame();
 }
 
@@ -57,6 +254,7 @@ void HexEnvironmentCommands::Register(GtpEngine& e, const std::string name)
     Register(e, "param_"+ name+ "_ice", &HexEnvironmentCommands::ParamICE);
     Register(e, "param_"+ name+ "_vc", &HexEnvironmentCommands::ParamVC);
     Register(e, "param_"+ name+ "_board", &HexEnvironmentCommands::ParamBoard);
+    BuildAnalyzeCommands(name);
 }
 
 void HexEnvironmentCommands::Register(GtpEngine& engine, 
@@ -67,63 +265,82 @@ void HexEnvironmentCommands::Register(GtpEngine& engine,
                     new GtpCallback<HexEnvironmentCommands>(this, method));
 }
 
-void HexEnvironmentCommands::AddAnalyzeCommands(HtpCommand& cmd,
-                                                const std::string& name)
+/** Expands the analyze command lines for the environment of the given
+    name. Done once at registration; AddAnalyzeCommands() only appends
+    the result. */
+void HexEnvironmentCommands::BuildAnalyzeCommands(const std::string& name)
 {
     std::string capName(name);
     capName[0] = (char)std::toupper(name[0]);
-    cmd << (boost::format("param/%1% ICE Param/param_%2%_ice\n") 
-            % capName % name);
-    cmd << (boost::format("param/%1% VC Param/param_%2%_vc\n") 
-            % capName % name);
-    cmd << (boost::format("param/%1% Board Param/param_%2%_board\n") 
-            % capName % name);
+    std::string& cmds = m_analyzeCommands;
+    cmds.clear();
+    cmds.reserve(3 * (capName.size() + name.size()) + 96);
+    cmds += "param/";
+    cmds += capName;
+    cmds += " ICE Param/param_";
+    cmds += name;
+    cmds += "_ice\n";
+    cmds += "param/";
+    cmds += capName;
+    cmds += " VC Param/param_";
+    cmds += name;
+    cmds += "_vc\n";
+    cmds += "param/";
+    cmds += capName;
+    cmds += " Board Param/param_";
+    cmds += name;
+    cmds += "_board\n";
+}
+
+void HexEnvironmentCommands::AddAnalyzeCommands(HtpCommand& cmd,
+                                                const std::string& name)
+{
+    if (m_analyzeCommands.empty())
+        BuildAnalyzeCommands(name);
+    cmd << m_analyzeCommands;
 }
 
 void HexEnvironmentCommands::ParamICE(HtpCommand& cmd)
 {
-    ICEngine& ice = m_env.ice; 
+    ICEngine& ice = m_env.ice;
     if (cmd.NuArg() == 0)
     {
-        cmd << '\n'
-            << "[bool] find_all_pattern_superiors "
-            << ice.FindAllPatternSuperiors() << '\n'
-            << "[bool] find_all_pattern_killers "
-            << ice.FindAllPatternKillers() << '\n'
-            << "[bool] find_presimplicial_pairs " 
-            << ice.FindPresimplicialPairs() << '\n'
-            << "[bool] find_three_sided_dead_regions "
-            << ice.FindThreeSidedDeadRegions() << '\n'
-            << "[bool] iterative_dead_regions "
-            << ice.IterativeDeadRegions() << '\n'
-	    << "[bool] use_capture "
-            << ice.UseCapture() << '\n'
-	    << "[bool] find_reversible "
-            << ice.FindReversible() << '\n'
-	    << "[bool] use_s_reversible_as_reversible "
-            << ice.UseSReversibleAsReversible() << '\n';
+        cmd << '\n';
+        for (const IceParamEntry& e : ICE_PARAM_TABLE)
+            cmd << "[bool] " << e.name << ' '
+                << IceParamValue(ice, e.id) << '\n';
     }
     else if (cmd.NuArg() == 2)
     {
-        std::string name = cmd.Arg(0);
-        if (name == "find_all_pattern_superiors")
+        switch (LookupIceParam(cmd.Arg(0)))
+        {
+        case IceParamId::FIND_ALL_PATTERN_SUPERIORS:
             ice.SetFindAllPatternSuperiors(cmd.Arg<bool>(1));
-        else if (name == "find_all_pattern_killers")
+            break;
+        case IceParamId::FIND_ALL_PATTERN_KILLERS:
             ice.SetFindAllPatternKillers(cmd.Arg<bool>(1));
-        else if (name == "find_presimplicial_pairs")
+            break;
+        case IceParamId::FIND_PRESIMPLICIAL_PAIRS:
             ice.SetFindPresimplicialPairs(cmd.Arg<bool>(1));
-        else if (name == "find_three_sided_dead_regions")
+            break;
+        case IceParamId::FIND_THREE_SIDED_DEAD_REGIONS:
             ice.SetFindThreeSidedDeadRegions(cmd.Arg<bool>(1));
-        else if (name == "iterative_dead_regions")
+            break;
+        case IceParamId::ITERATIVE_DEAD_REGIONS:
             ice.SetIterativeDeadRegions(cmd.Arg<bool>(1));
-	else if (name == "use_capture")
+            break;
+        case IceParamId::USE_CAPTURE:
             ice.SetUseCapture(cmd.Arg<bool>(1));
-	else if (name == "find_reversible")
+            break;
+        case IceParamId::FIND_REVERSIBLE:
             ice.SetFindReversible(cmd.Arg<bool>(1));
-	else if (name == "use_s_reversible_as_reversible")
+            break;
+        case IceParamId::USE_S_REVERSIBLE_AS_REVERSIBLE:
             ice.SetUseSReversibleAsReversible(cmd.Arg<bool>(1));
-        else
-            throw HtpFailure() << "Unknown parameter: " << name;
+            break;
+        default:
+            throw HtpFailure() << "Unknown parameter: " << cmd.Arg(0);
+        }
     }
     else
         throw HtpFailure() << "Expected 0 or 2 arguments";
@@ -131,41 +348,40 @@ void HexEnvironmentCommands::ParamICE(HtpCommand& cmd)
 
 void HexEnvironmentCommands::ParamVC(HtpCommand& cmd)
 {
-    HexBoard& brd = *m_env.brd; 
+    HexBoard& brd = *m_env.brd;
     VCBuilderParam& param = brd.VCBuilderParameters();
     if (cmd.NuArg() == 0)
     {
-        cmd << '\n'
-            << "[bool] and_over_edge "
-            << param.and_over_edge << '\n'
-            << "[bool] use_patterns "
-            << param.use_patterns << '\n'
-            << "[bool] use_non_edge_patterns "
-            << param.use_non_edge_patterns << '\n'
-            << "[bool] incremental_builds "
-            << param.incremental_builds << '\n'
-            << "[bool] limit_fulls "
-            << param.limit_fulls << '\n'
-            << "[bool] limit_or "
-            << param.limit_or << '\n';
+        cmd << '\n';
+        for (const VCParamEntry& e : VC_PARAM_TABLE)
+            cmd << "[bool] " << e.name << ' '
+                << VCParamValue(param, e.id) << '\n';
     }
     else if (cmd.NuArg() == 2)
     {
-        std::string name = cmd.Arg(0);
-        if (name == "and_over_edge")
+        switch (LookupVCParam(cmd.Arg(0)))
+        {
+        case VCParamId::AND_OVER_EDGE:
             param.and_over_edge = cmd.Arg<bool>(1);
-        else if (name == "use_patterns")
+            break;
+        case VCParamId::USE_PATTERNS:
             param.use_patterns = cmd.Arg<bool>(1);
-        else if (name == "use_non_edge_patterns")
+            break;
+        case VCParamId::USE_NON_EDGE_PATTERNS:
             param.use_non_edge_patterns = cmd.Arg<bool>(1);
-        else if (name == "incremental_builds")
+            break;
+        case VCParamId::INCREMENTAL_BUILDS:
             param.incremental_builds = cmd.Arg<bool>(1);
-        else if (name == "limit_fulls")
+            break;
+        case VCParamId::LIMIT_FULLS:
             param.limit_fulls = cmd.Arg<bool>(1);
-        else if (name == "limit_or")
+            break;
+        case VCParamId::LIMIT_OR:
             param.limit_or = cmd.Arg<bool>(1);
-        else
-            throw HtpFailure() << "Unknown parameter: " << name;
+            break;
+        default:
+            throw HtpFailure() << "Unknown parameter: " << cmd.Arg(0);
+        }
     }
     else
         throw HtpFailure() << "Expected 0 or 2 arguments";
@@ -173,32 +389,33 @@ void HexEnvironmentCommands::ParamVC(HtpCommand& cmd)
 
 void HexEnvironmentCommands::ParamBoard(HtpCommand& cmd)
 {
-    HexBoard& brd = *m_env.brd; 
+    HexBoard& brd = *m_env.brd;
     if (cmd.NuArg() == 0)
     {
-        cmd << '\n'
-            << "[bool] backup_ice_info "
-            << brd.BackupIceInfo() << '\n'
-            << "[bool] use_decompositions "
-            << brd.UseDecompositions() << '\n'
-            << "[bool] use_ice "
-            << brd.UseICE() << '\n'
-            << "[bool] use_vcs "
-            << brd.UseVCs() << '\n';
+        cmd << '\n';
+        for (const BoardParamEntry& e : BOARD_PARAM_TABLE)
+            cmd << "[bool] " << e.name << ' '
+                << BoardParamValue(brd, e.id) << '\n';
     }
     else if (cmd.NuArg() == 2)
     {
-        std::string name = cmd.Arg(0);
-        if (name == "backup_ice_info")
+        switch (LookupBoardParam(cmd.Arg(0)))
+        {
+        case BoardParamId::BACKUP_ICE_INFO:
             brd.SetBackupIceInfo(cmd.Arg<bool>(1));
-        else if (name == "use_decompositions")
+            break;
+        case BoardParamId::USE_DECOMPOSITIONS:
             brd.SetUseDecompositions(cmd.Arg<bool>(1));
-        else if (name == "use_ice")
+            break;
+        case BoardParamId::USE_ICE:
             brd.SetUseICE(cmd.Arg<bool>(1));
-        else if (name == "use_vcs")
+            break;
+        case BoardParamId::USE_VCS:
             brd.SetUseVCs(cmd.Arg<bool>(1));
-        else 
-            throw HtpFailure() << "Unknown parameter: " << name;
+            break;
+        default:
+            throw HtpFailure() << "Unknown parameter: " << cmd.Arg(0);
+        }
     }
     else
         throw HtpFailure() << "Expected 0 or 2 arguments";
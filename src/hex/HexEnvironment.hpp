@@ -48,6 +48,12 @@ private:
 
     HexEnvironment& m_env;
 
+    /** Analyze command lines for this environment, built once in
+        Register() so AddAnalyzeCommands() is a single append. */
+    std::string m_analyzeCommands;
+
+    void BuildAnalyzeCommands(const std::string& name);
+
     void ParamICE(HtpCommand& cmd);
     void ParamVC(HtpCommand& cmd);
     void ParamBoard(HtpCommand& board);
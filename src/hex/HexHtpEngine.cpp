@@ -390,7 +390,7 @@ void HexHtpEngine::CmdParamGame(HtpCommand& cmd)
     }
     else if (cmd.NuArg() == 2)
     {
-        std::string name = cmd.Arg(0);
+        const std::string& name = cmd.Arg(0);
         if (name == "allow_swap")
             m_game.SetAllowSwap(cmd.Arg<bool>(1));
         else if (name == "on_little_golem")
@@ -122,6 +122,12 @@ PatternState::~PatternState()
 {
 }
 
+void PatternState::BoardSizeChanged()
+{
+    m_data = PatternMatcherData::Get(&m_brd.Const());
+    ClearGodels();
+}
+
 //----------------------------------------------------------------------------
 
 void PatternState::UpdateRingGodel(HexPoint cell)
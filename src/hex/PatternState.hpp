@@ -178,6 +178,12 @@ public:
     /** Copies state from other. */
     void CopyState(const PatternState& other);
 
+    /** Must be called after the size of the tracked board changes;
+        refetches the per-boardsize matcher data and clears the
+        godels. The matcher data is cached per boardsize, so no
+        reinitialization occurs for a previously seen size. */
+    void BoardSizeChanged();
+
     /** Sets the distance to which we update pattern info from the
         last played cell; used in Update(cell). Default is
         Pattern::MAX_EXTENSION. */
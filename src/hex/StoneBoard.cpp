@@ -169,6 +169,13 @@ void StoneBoard::StartNewGame()
     ComputeHash();
 }
 
+void StoneBoard::SetSize(int width, int height)
+{
+    m_const = &ConstBoard::Get(width, height);
+    m_hash = ZobristHash(width, height);
+    StartNewGame();
+}
+
 void StoneBoard::PlayMove(HexColor color, HexPoint cell)
 {
     BenzeneAssert(HexColorUtil::isBlackWhite(color));
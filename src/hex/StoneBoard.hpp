@@ -217,6 +217,10 @@ public:
     /** Clears the board and plays the edge stones. */
     void StartNewGame();
 
+    /** Changes the size of the board. Clears the board and starts a
+        new game. */
+    void SetSize(int width, int height);
+
     /** Adds some played stones. Hash is recomputed.  @see Hash(). */
     void AddPlayed(const bitset_t& p);
 
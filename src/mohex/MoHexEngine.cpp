@@ -258,7 +258,7 @@ void MoHexEngine::MoHexPolicyParam(HtpCommand& cmd)
     }
     else if (cmd.NuArg() == 2)
     {
-        std::string name = cmd.Arg(0);
+        const std::string& name = cmd.Arg(0);
         if (name == "pattern_heuristic")
             config.patternHeuristic = cmd.Arg<bool>(1);
         else
@@ -353,7 +353,7 @@ void MoHexEngine::MoHexParam(HtpCommand& cmd)
     }
     else if (cmd.NuArg() == 2)
     {
-        std::string name = cmd.Arg(0);
+        const std::string& name = cmd.Arg(0);
         if (name == "backup_ice_info")
             m_player.SetBackupIceInfo(cmd.Arg<bool>(1));
         else if (name == "extend_unstable_search")
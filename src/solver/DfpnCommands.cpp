@@ -98,7 +98,7 @@ void DfpnCommands::CmdParamSolverDB(HtpCommand& cmd)
     }
     else if (cmd.NuArg() == 2)
     {
-        std::string name = cmd.Arg(0);
+        const std::string& name = cmd.Arg(0);
         if (name == "use_flipped_states")
             param.m_useFlippedStates = cmd.Arg<bool>(1);
         else if (name == "use_proof_transpositions")
@@ -152,7 +152,7 @@ void DfpnCommands::CmdParam(HtpCommand& cmd)
     }
     else if (cmd.NuArg() == 2)
     {
-        std::string name = cmd.Arg(0);
+        const std::string& name = cmd.Arg(0);
         if (name == "use_guifx")
             m_solver.SetUseGuiFx(cmd.Arg<bool>(1));
         else if (name == "guifx_deep_bounds")
@@ -80,7 +80,7 @@ void DfsCommands::CmdParamSolverDB(HtpCommand& cmd)
     }
     else if (cmd.NuArg() == 2)
     {
-        std::string name = cmd.Arg(0);
+        const std::string& name = cmd.Arg(0);
         if (name == "use_flipped_states")
             param.m_useFlippedStates = cmd.Arg<bool>(1);
         else if (name == "use_proof_transpositions")
@@ -118,7 +118,7 @@ void DfsCommands::CmdParamSolver(HtpCommand& cmd)
     }
     else if (cmd.NuArg() == 2)
     {
-        std::string name = cmd.Arg(0);
+        const std::string& name = cmd.Arg(0);
         if (name == "backup_ice_info")
             m_solver.SetBackupIceInfo(cmd.Arg<bool>(1));
         else if (name == "shrink_proofs")
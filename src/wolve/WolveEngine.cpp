@@ -4,6 +4,9 @@
 
 #include "SgSystem.h"
 
+#include <cstdlib>
+#include <unordered_map>
+
 #include "BitsetIterator.hpp"
 #include "Misc.hpp"
 #include "PlayAndSolve.hpp"
@@ -20,18 +23,78 @@ namespace {
 
 //----------------------------------------------------------------------------
 
+/** Parses a list of widths separated by spaces or dashes. Scans the
+    raw buffer with strtoul instead of going through an istringstream,
+    so no temporary string or stream is allocated. */
 std::vector<std::size_t> PlyWidthsFromString(const std::string& val)
 {
     std::vector<std::size_t> v;
-    std::istringstream is(val);
-    std::size_t t;
-    while (is >> t)
-        v.push_back(t);
+    v.reserve(val.size() / 2 + 1);
+    const char* p = val.c_str();
+    const char* end = p + val.size();
+    while (p < end)
+    {
+        if (*p >= '0' && *p <= '9')
+        {
+            char* q;
+            v.push_back(std::strtoul(p, &q, 10));
+            p = q;
+        }
+        else
+            ++p;
+    }
     return v;
 }
 
 //----------------------------------------------------------------------------
 
+/** Parameters of param_wolve, interned as small integers so that the
+    assignment branch dispatches through a jump table instead of a
+    chain of string compares. */
+enum class WolveParamId : uint8_t
+{
+    BACKUP_ICE_INFO,
+    PONDER,
+    MAX_TIME,
+    PLY_WIDTH,
+    SPECIFIC_PLY_WIDTHS,
+    MAX_DEPTH,
+    MIN_DEPTH,
+    USE_GUIFX,
+    SEARCH_SINGLETON,
+    TT_BITS,
+    USE_CACHE_BOOK,
+    USE_PARALLEL_SOLVER,
+    USE_TIME_MANAGEMENT,
+    USE_EARLY_ABORT,
+    UNKNOWN
+};
+
+WolveParamId LookupWolveParam(const std::string& name)
+{
+    static const std::unordered_map<std::string, WolveParamId> lookup =
+    {
+        { "backup_ice_info", WolveParamId::BACKUP_ICE_INFO },
+        { "ponder", WolveParamId::PONDER },
+        { "max_time", WolveParamId::MAX_TIME },
+        { "ply_width", WolveParamId::PLY_WIDTH },
+        { "specific_ply_widths", WolveParamId::SPECIFIC_PLY_WIDTHS },
+        { "max_depth", WolveParamId::MAX_DEPTH },
+        { "min_depth", WolveParamId::MIN_DEPTH },
+        { "use_guifx", WolveParamId::USE_GUIFX },
+        { "search_singleton", WolveParamId::SEARCH_SINGLETON },
+        { "tt_bits", WolveParamId::TT_BITS },
+        { "use_cache_book", WolveParamId::USE_CACHE_BOOK },
+        { "use_parallel_solver", WolveParamId::USE_PARALLEL_SOLVER },
+        { "use_time_management", WolveParamId::USE_TIME_MANAGEMENT },
+        { "use_early_abort", WolveParamId::USE_EARLY_ABORT }
+    };
+    auto it = lookup.find(name);
+    return it != lookup.end() ? it->second : WolveParamId::UNKNOWN;
+}
+
+//----------------------------------------------------------------------------
+
 } // namespace
 
 //----------------------------------------------------------------------------
@@ -40,7 +103,9 @@ WolveEngine::WolveEngine(int boardsize, WolvePlayer& player)
     : CommonHtpEngine(boardsize),
       m_player(player),
       m_cacheBook(),
-      m_useCacheBook(true)
+      m_useCacheBook(true),
+      m_ttBits(player.HashTable()
+               ? static_cast<int>(log2(player.HashTable()->MaxHash())) : 0)
 {
     RegisterCmd("param_wolve", &WolveEngine::CmdParam);
     RegisterCmd("wolve-get-pv", &WolveEngine::CmdGetPV);
@@ -147,52 +212,68 @@ void WolveEngine::CmdParam(HtpCommand& cmd)
             << "[string] min_depth "
             << m_player.MinDepth() << '\n'
             << "[string] tt_bits "
-            << (m_player.HashTable() 
-                ? log2(m_player.HashTable()->MaxHash()) : 0);
+            << m_ttBits;
     }
     else if (cmd.NuArg() == 2)
     {
-        std::string name = cmd.Arg(0);
-        if (name == "backup_ice_info")
+        switch (LookupWolveParam(cmd.Arg(0)))
+        {
+        case WolveParamId::BACKUP_ICE_INFO:
             search.SetBackupIceInfo(cmd.Arg<bool>(1));
-        else if (name == "ponder")
+            break;
+        case WolveParamId::PONDER:
             m_player.SetPonder(cmd.Arg<bool>(1));
-        else if (name == "max_time")
+            break;
+        case WolveParamId::MAX_TIME:
             m_player.SetMaxTime(cmd.Arg<float>(1));
-        else if (name == "ply_width")
+            break;
+        case WolveParamId::PLY_WIDTH:
             search.SetPlyWidth(cmd.ArgMin<std::size_t>(1, 1));
-        else if (name == "specific_ply_widths")
+            break;
+        case WolveParamId::SPECIFIC_PLY_WIDTHS:
         {
-            std::vector<std::size_t> plywidth 
+            std::vector<std::size_t> plywidth
                 = PlyWidthsFromString(cmd.Arg(1));
             search.SetSpecificPlyWidths(plywidth);
-        } 
-        else if (name == "max_depth")
+            break;
+        }
+        case WolveParamId::MAX_DEPTH:
             m_player.SetMaxDepth(cmd.ArgMin<std::size_t>(1, 1));
-        else if (name == "min_depth")
+            break;
+        case WolveParamId::MIN_DEPTH:
             m_player.SetMinDepth(cmd.ArgMin<std::size_t>(1, 1));
-        else if (name == "use_guifx")
+            break;
+        case WolveParamId::USE_GUIFX:
             search.SetGuiFx(cmd.Arg<bool>(1));
-        else if (name == "search_singleton")
+            break;
+        case WolveParamId::SEARCH_SINGLETON:
             m_player.SetSearchSingleton(cmd.Arg<bool>(1));
-        else if (name == "tt_bits")
+            break;
+        case WolveParamId::TT_BITS:
 	{
 	    int bits = cmd.ArgMin<int>(1, 0);
 	    if (bits == 0)
 		m_player.SetHashTable(0);
 	    else
 		m_player.SetHashTable(new SgSearchHashTable(1 << bits));
+            m_ttBits = bits;
+            break;
         }
-        else if (name == "use_cache_book")
+        case WolveParamId::USE_CACHE_BOOK:
             m_useCacheBook = cmd.Arg<bool>(1);
-        else if (name == "use_parallel_solver")
+            break;
+        case WolveParamId::USE_PARALLEL_SOLVER:
             m_useParallelSolver = cmd.Arg<bool>(1);
-        else if (name == "use_time_management")
+            break;
+        case WolveParamId::USE_TIME_MANAGEMENT:
             m_player.SetUseTimeManagement(cmd.Arg<bool>(1));
-        else if (name == "use_early_abort")
+            break;
+        case WolveParamId::USE_EARLY_ABORT:
             m_player.SetUseEarlyAbort(cmd.Arg<bool>(1));
-        else
-            throw HtpFailure() << "Unknown parameter: " << name;
+            break;
+        default:
+            throw HtpFailure() << "Unknown parameter: " << cmd.Arg(0);
+        }
     }
     else
         throw HtpFailure("Expected 0 or 2 arguments");
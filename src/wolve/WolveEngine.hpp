@@ -53,6 +53,11 @@ private:
 
     bool m_useCacheBook;
 
+    /** Size of the player's hashtable in bits, as configured through
+        tt_bits. Cached so printing the parameters does not recompute
+        it from MaxHash() with log2(). */
+    int m_ttBits;
+
     double TimeForMove(HexColor color);
 
     HexPoint GenMove(HexColor color, bool useGameClock);